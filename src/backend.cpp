@@ -9,6 +9,7 @@
 #include <libtorrent/magnet_uri.hpp>
 #include <libtorrent/load_torrent.hpp>
 #include <libtorrent/create_torrent.hpp>
+#include <libtorrent/session_params.hpp>
 
 
 namespace mt {
@@ -84,6 +85,32 @@ namespace mt {
         of.write(b.data(), int(b.size()));
     }
 
+    bool save_session_state(const lt::session &ses) noexcept try {
+        fs::path path = storage_dir() + "/.session";
+        fs::path tmp_path = storage_dir() + "/.session.tmp";
+
+        const std::vector<char> b = lt::write_session_params_buf(ses.session_state(),
+                                                                 lt::save_state_flags_t::all());
+        {
+            std::ofstream of(tmp_path, std::ios_base::binary | std::ios_base::trunc);
+            of.unsetf(std::ios_base::skipws);
+            of.write(b.data(), std::streamsize(b.size()));
+            of.flush();
+            if (!of) return false;
+        }
+
+        // renaming over the old file is atomic, so readers only ever see a complete snapshot
+        std::error_code ec;
+        fs::rename(tmp_path, path, ec);
+        if (ec) {
+            fs::remove(tmp_path, ec);
+            return false;
+        }
+        return true;
+    } catch (std::exception &) {
+        return false;
+    }
+
     void
     create_torrent(const std::string &folder, const std::string_view &save_path, const std::string &tracker_url) {
         // This is a libtorrent precondition so if it doesn't hold we get eviscerated
@@ -6,6 +6,7 @@
 #include <vector>
 #include <libtorrent/torrent_status.hpp>
 #include <libtorrent/alert_types.hpp>
+#include <libtorrent/session.hpp>
 
 namespace mt {
     /// @brief Return the directory in which MicroTorrent will store all its data
@@ -32,6 +33,13 @@ namespace mt {
     /// @brief Write the resume data provided to disk for storage
     void save_torrent_data(const lt::save_resume_data_alert *alert);
 
+    /// @brief Snapshot the session's state (settings, DHT node cache & IP filter) to disk
+    ///
+    /// The state is written to a temporary file which is then renamed over `.session`,
+    /// so a crash mid-write never leaves a truncated session file behind
+    /// @returns Whether the snapshot was written successfully
+    bool save_session_state(const lt::session &ses) noexcept;
+
     /// @brief Load a torrent file from either a file path or magnet link
     /// @returns The `add_torrent_params` object for the requested torrent.
     /// Will throw an exception if parsing fails
@@ -22,6 +22,10 @@ namespace {
     // set when we're exiting
     std::atomic<bool> shut_down{false};
 
+    // how often the session state (incl. the DHT node cache) is snapshotted to disk,
+    // so a crash doesn't cost us our routing table
+    constexpr auto session_snapshot_interval = std::chrono::seconds(60);
+
     void sighandler(int) { shut_down = true; }
 
 }  // anonymous namespace
@@ -56,7 +60,7 @@ void update_blacklist(const std::vector<lt::ip_range<lt::address_v4>> &ipv4,
     });
 }
 
-void event_loop(lt::session &ses, clk::time_point last_save_resume, slint::ComponentWeakHandle<MainWindow> ui_weak,
+void event_loop(lt::session &ses, clk::time_point start_time, clk::time_point last_save_resume, slint::ComponentWeakHandle<MainWindow> ui_weak,
                 msd::channel<mt::add_request> &add_reqs, msd::channel<mt::remove_request> &del_reqs,
                 msd::channel<mt::create_request> &create_reqs,
                 msd::channel<mt::update_blacklist_request> &blacklist_updates) {
@@ -64,6 +68,9 @@ void event_loop(lt::session &ses, clk::time_point last_save_resume, slint::Compo
     auto infos = std::make_shared<slint::VectorModel<TorrentInfo>>();
     // set when we're exiting
     bool done = false;
+    // set once we've connected to a peer, so we only report the startup time once
+    bool seen_first_peer = false;
+    clk::time_point last_session_snapshot = clk::now();
     for (;;) {
         std::vector<lt::alert *> alerts;
         ses.pop_alerts(&alerts);
@@ -146,6 +153,10 @@ void event_loop(lt::session &ses, clk::time_point last_save_resume, slint::Compo
             }
 
             ses.set_ip_filter(filter);
+            // persist the blocklist straight away rather than waiting for the next snapshot
+            if (!mt::save_session_state(ses)) {
+                std::cerr << "\nfailed to save IP filter" << std::endl;
+            }
 
             auto ranges = filter.export_filter();
             update_blacklist(std::get<0>(ranges), std::get<1>(ranges), ui_weak);
@@ -229,6 +240,13 @@ void event_loop(lt::session &ses, clk::time_point last_save_resume, slint::Compo
                 auto peers = std::make_shared<slint::VectorModel<slint::SharedString>>();
 
                 for (auto const &s: st->status) {
+                    if (!seen_first_peer && s.num_peers > 0) {
+                        seen_first_peer = true;
+                        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                clk::now() - start_time);
+                        std::cerr << "\ntime to first peer: " << elapsed.count() << " ms" << std::endl;
+                    }
+
                     // print to console for debugging
                     std::cerr << '\r' << s.name << ": " << mt::state(s.state) << ' '
                               << (s.download_payload_rate / 1000) << " kB/s "
@@ -295,23 +313,30 @@ void event_loop(lt::session &ses, clk::time_point last_save_resume, slint::Compo
             last_save_resume = clk::now();
         }
 
+        // snapshot the session state in case we don't get to shut down cleanly
+        if (clk::now() - last_session_snapshot > session_snapshot_interval) {
+            if (!mt::save_session_state(ses)) {
+                std::cerr << "\nfailed to snapshot session state" << std::endl;
+            }
+            last_session_snapshot = clk::now();
+        }
+
         if (done) goto done;
     }
 
     done:
     std::cerr << "\nsaving session state" << std::endl;
-    {
-        std::ofstream of(mt::storage_dir() + "/.session", std::ios_base::binary);
-        of.unsetf(std::ios_base::skipws);
-        const std::vector<char> b = write_session_params_buf(ses.session_state(),
-                                                             lt::save_state_flags_t::all());
-        of.write(b.data(), int(b.size()));
+    if (!mt::save_session_state(ses)) {
+        std::cerr << "\nfailed to save session state" << std::endl;
     }
 
     std::cerr << "\ndone, shutting down" << std::endl;
 }
 
 int main() try {
+    // used to measure how long it takes to get our first peer, since that's where
+    // a warm DHT routing table makes the biggest difference
+    clk::time_point start_time = clk::now();
     auto ui = MainWindow::create();
 
     // create the storage directory if it doesn't exist already
@@ -330,6 +355,8 @@ int main() try {
                             lt::alert_category::storage |
                             lt::alert_category::status);
 
+    std::cerr << (session_params.empty() ? "cold" : "warm") << " start" << std::endl;
+
     lt::session ses(params);
     clk::time_point last_save_resume = clk::now();
 
@@ -400,8 +427,8 @@ int main() try {
     }
 
     std::thread event_thread{
-            [ui_weak, &ses, &last_save_resume, &add_channel, &remove_channel, &create_channel, &block_channel]() {
-                event_loop(ses, last_save_resume, ui_weak, add_channel, remove_channel, create_channel,
+            [ui_weak, &ses, start_time, &last_save_resume, &add_channel, &remove_channel, &create_channel, &block_channel]() {
+                event_loop(ses, start_time, last_save_resume, ui_weak, add_channel, remove_channel, create_channel,
                            block_channel);
             }};
 